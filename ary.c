@@ -2,6 +2,7 @@
 #include <math.h> // fabs(), isinf(), isnan()
 #include <assert.h> // assert()
 #include <stdio.h> // NULL
+#include <stdlib.h> // malloc(), free(), qsort()
 
 // ------------------- UTILS -------------------
 
@@ -95,6 +96,29 @@ bool in_wartosc(wartosc w, double x) {
 	return geq(x, w.first) && leq(x, w.second);
 }
 
+void in_wartosc_wiele(wartosc w, const double* x, bool* wynik, size_t n) {
+	assert(n == 0 || (x != NULL && wynik != NULL));
+
+	if(isnan(w.first)) {
+		for(size_t i = 0; i < n; i++) wynik[i] = false;
+		return;
+	}
+	// the loops below are branch-free (compares are combined with bitwise operators
+	// instead of || and &&); gcc vectorises them into compare-and-mask only with
+	// -O3 -march=native, at the makefile's -O1 / -O2 they stay scalar
+	if(w.is_flipped) {
+		for(size_t i = 0; i < n; i++) {
+			wynik[i] = ((x[i] > w.first) | (fabs(x[i] - w.first) < EPS))
+					| ((x[i] < w.second) | (fabs(x[i] - w.second) < EPS));
+		}
+		return;
+	}
+	for(size_t i = 0; i < n; i++) {
+		wynik[i] = ((x[i] > w.first) | (fabs(x[i] - w.first) < EPS))
+				& ((x[i] < w.second) | (fabs(x[i] - w.second) < EPS));
+	}
+}
+
 double min_wartosc(wartosc w) {
 	if(isnan(w.first)) return NAN;
 
@@ -274,6 +298,146 @@ wartosc podzielic(wartosc a, wartosc b) {
 	return razy(a, inverse(b));
 }
 
+// ------------------- BATCH OPERATIONS -------------------
+// The batches are the operations on single values in a loop, which also collect the
+// emptiness of the results into a bitmask per block of 64 lanes and count it in the
+// report. They are no faster than such a loop written by hand.
+
+// the number of set bits of x (empty results are rare, so the loop is short)
+size_t count_bits(uint64_t x) {
+	size_t res = 0;
+	for(; x != 0; x &= x - 1) res++;
+	return res;
+}
+
+// computes wynik[i] = op(a[i], b[i]) for i = 0..n-1 with the report; divide is set
+// for podzielic, to count the divisions by [0; 0]
+// (inline, so that every *_wiele gets its own copy with a direct call to op)
+static inline raport_wiele batch(const wartosc* a, const wartosc* b, wartosc* wynik, size_t n, uint64_t* puste,
+		wartosc (*op)(wartosc, wartosc), bool divide) {
+	assert(n == 0 || (a != NULL && b != NULL && wynik != NULL));
+
+	raport_wiele raport = {.puste = 0, .dzielenie_przez_zero = 0};
+	for(size_t start = 0; start < n; start += 64) {
+		size_t len = n - start < 64 ? n - start : 64;
+		const wartosc *x = a + start, *y = b + start;
+		wartosc* res = wynik + start;
+
+		uint64_t empty = 0, zero = 0;
+		for(size_t i = 0; i < len; i++) {
+			// y[i] is read before res[i] is written (res might be equal to x or y)
+			if(divide) zero |= (uint64_t)(eq(y[i].first, 0.0) & eq(y[i].second, 0.0)) << i;
+			res[i] = op(x[i], y[i]);
+			empty |= (uint64_t)(isnan(res[i].first) != 0) << i;
+		}
+		raport.puste += count_bits(empty);
+		raport.dzielenie_przez_zero += count_bits(zero);
+		if(puste != NULL) puste[start / 64] = empty;
+	}
+	return raport;
+}
+
+raport_wiele plus_wiele(const wartosc* a, const wartosc* b, wartosc* wynik, size_t n, uint64_t* puste) {
+	return batch(a, b, wynik, n, puste, plus, false);
+}
+raport_wiele minus_wiele(const wartosc* a, const wartosc* b, wartosc* wynik, size_t n, uint64_t* puste) {
+	return batch(a, b, wynik, n, puste, minus, false);
+}
+raport_wiele razy_wiele(const wartosc* a, const wartosc* b, wartosc* wynik, size_t n, uint64_t* puste) {
+	return batch(a, b, wynik, n, puste, razy, false);
+}
+raport_wiele podzielic_wiele(const wartosc* a, const wartosc* b, wartosc* wynik, size_t n, uint64_t* puste) {
+	return batch(a, b, wynik, n, puste, podzielic, true);
+}
+
+// ------------------- SETS -------------------
+
+// a closed segment [a; b]
+typedef struct odcinek {
+	double a, b;
+} odcinek;
+
+// compares segments by their left endpoints (for qsort)
+int compare_odcinek(const void* x, const void* y) {
+	double a = ((const odcinek*)x)->a, b = ((const odcinek*)y)->a;
+	return (a > b) - (a < b);
+}
+
+zbior_wartosci zbior_utworz(const wartosc* w, size_t n) {
+	assert(n == 0 || w != NULL);
+
+	zbior_wartosci res = {.poczatki = NULL, .konce = NULL, .rozmiar = 0};
+	if(n == 0) return res;
+
+	// every wartosc is at most two segments (if it is flipped)
+	odcinek* segs = malloc(2 * n * sizeof(odcinek));
+	assert(segs != NULL);
+	size_t k = 0;
+	for(size_t i = 0; i < n; i++) {
+		if(isnan(w[i].first)) continue; // empty set
+		if(w[i].is_flipped) {
+			segs[k++] = (odcinek){.a = -HUGE_VAL, .b = w[i].second};
+			segs[k++] = (odcinek){.a = w[i].first, .b = HUGE_VAL};
+		} else {
+			segs[k++] = (odcinek){.a = w[i].first, .b = w[i].second};
+		}
+	}
+	if(k == 0) {
+		free(segs);
+		return res;
+	}
+	qsort(segs, k, sizeof(odcinek), compare_odcinek);
+
+	res.poczatki = malloc(k * sizeof(double));
+	res.konce = malloc(k * sizeof(double));
+	assert(res.poczatki != NULL && res.konce != NULL);
+	res.poczatki[0] = segs[0].a;
+	res.konce[0] = segs[0].b;
+	res.rozmiar = 1;
+	for(size_t i = 1; i < k; i++) {
+		// segments closer than 2 * EPS are merged, since every point of the gap
+		// is in one of them anyway (with epsilon approximation) [*3]
+		if(segs[i].a < res.konce[res.rozmiar - 1] + 2.0 * EPS) {
+			res.konce[res.rozmiar - 1] = max(res.konce[res.rozmiar - 1], segs[i].b);
+		} else {
+			res.poczatki[res.rozmiar] = segs[i].a;
+			res.konce[res.rozmiar] = segs[i].b;
+			res.rozmiar++;
+		}
+	}
+	free(segs);
+	return res;
+}
+
+void zbior_usun(zbior_wartosci* z) {
+	assert(z != NULL);
+
+	free(z->poczatki);
+	free(z->konce);
+	*z = (zbior_wartosci){.poczatki = NULL, .konce = NULL, .rozmiar = 0};
+}
+
+bool in_zbior(const zbior_wartosci* z, double x) {
+	assert(z != NULL);
+
+	// binary search for the number of segments starting at or before x
+	size_t lo = 0, hi = z->rozmiar;
+	while(lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+		if(geq(x, z->poczatki[mid])) lo = mid + 1;
+		else hi = mid;
+	}
+	// only the last of them can contain x, because the segments are disjoint [*3]
+	return lo > 0 && leq(x, z->konce[lo - 1]);
+}
+
+void in_zbior_wiele(const zbior_wartosci* z, const double* x, bool* wynik, size_t n) {
+	assert(n == 0 || (x != NULL && wynik != NULL));
+
+	for(size_t i = 0; i < n; i++) {
+		wynik[i] = in_zbior(z, x[i]);
+	}
+}
 
 // ------------------- NOTES -------------------
 // In the struct wartosc, the fields have the following meanings:
@@ -290,4 +454,6 @@ wartosc podzielic(wartosc a, wartosc b) {
 //
 // [*1] e.g. not to have NAN for test: [0, 0] * [-inf, inf] = [0, 0]
 // [*2] e.g. not to have NAN for test: [-inf, inf] * [1, 0] = [-inf, inf]
-//
\ No newline at end of file
+//
+// [*3] In zbior_wartosci the segments are sorted and pairwise more than 2 * EPS apart,
+// so for any x at most one of them contains x (with epsilon approximation).
@@ -2,6 +2,8 @@
 #define _ARY_H_
 
 #include "stdbool.h"
+#include "stddef.h"
+#include "stdint.h"
 
 typedef struct wartosc {
 	double first, second; // segment endpoints
@@ -11,6 +13,9 @@ typedef struct wartosc {
 /* Implicite zakładamy, że wszystkie argumenty typu double są liczbami  */
 /* rzeczywistymi, tzn. są różne od HUGE_VAL, -HUGE_VAL i NAN. */
 
+/* Dokładność porównań końców przedziałów.                */
+extern const double EPS;
+
 /* wartosc_dokladnosc(x, p, &wynik) ustawia w na x +/- p% */
 /* warunek początkowy: p > 0                              */
 wartosc wartosc_dokladnosc(double x, double p);
@@ -25,6 +30,10 @@ wartosc wartosc_dokladna(double x);
 /* in_wartosc(&w, x) = x \in w */
 bool in_wartosc(wartosc w, double x);
 
+/* in_wartosc_wiele(&w, x, wynik, n) ustawia             */
+/* wynik[i] = x[i] \in w dla i = 0..n-1                  */
+void in_wartosc_wiele(wartosc w, const double* x, bool* wynik, size_t n);
+
 /* min_wartosc(&w) = najmniejsza możliwa wartość w,       */
 /* lub -HUGE_VAL jeśli brak dolnego ograniczenia.         */
 double min_wartosc(wartosc w);
@@ -43,4 +52,40 @@ wartosc minus(wartosc a, wartosc b);
 wartosc razy(wartosc a, wartosc b);
 wartosc podzielic(wartosc a, wartosc b);
 
+/* Raport z operacji na tablicach.                        */
+typedef struct raport_wiele {
+	size_t puste; // number of empty results
+	size_t dzielenie_przez_zero; // number of divisions by [0; 0]
+} raport_wiele;
+
+/* Operacje na tablicach: wynik[i] = a[i] op b[i]         */
+/* dla i = 0..n-1 (wynik może być równy a lub b).         */
+/* Jeśli puste != NULL, to bit i % 64 słowa puste[i / 64] */
+/* jest ustawiony wtw, gdy wynik[i] jest pusty            */
+/* (tablica puste ma (n + 63) / 64 elementów).            */
+raport_wiele plus_wiele(const wartosc* a, const wartosc* b, wartosc* wynik, size_t n, uint64_t* puste);
+raport_wiele minus_wiele(const wartosc* a, const wartosc* b, wartosc* wynik, size_t n, uint64_t* puste);
+raport_wiele razy_wiele(const wartosc* a, const wartosc* b, wartosc* wynik, size_t n, uint64_t* puste);
+raport_wiele podzielic_wiele(const wartosc* a, const wartosc* b, wartosc* wynik, size_t n, uint64_t* puste);
+
+/* Suma wielu wartości z indeksem do szybkich zapytań:   */
+/* rozłączne odcinki [poczatki[i]; konce[i]] posortowane  */
+/* rosnąco, i = 0..rozmiar-1.                             */
+typedef struct zbior_wartosci {
+	double *poczatki, *konce; // segment endpoints
+	size_t rozmiar;
+} zbior_wartosci;
+
+/* zbior_utworz(w, n) = w[0] u w[1] u ... u w[n-1]        */
+/* wynik należy zwolnić przez zbior_usun                  */
+zbior_wartosci zbior_utworz(const wartosc* w, size_t n);
+void zbior_usun(zbior_wartosci* z);
+
+/* in_zbior(&z, x) = x \in z                              */
+bool in_zbior(const zbior_wartosci* z, double x);
+
+/* in_zbior_wiele(&z, x, wynik, n) ustawia                */
+/* wynik[i] = x[i] \in z dla i = 0..n-1                  */
+void in_zbior_wiele(const zbior_wartosci* z, const double* x, bool* wynik, size_t n);
+
 #endif
@@ -0,0 +1,373 @@
+#include "ary_dd.h"
+#include <math.h> // fabs(), fma(), isinf(), isnan(), nextafter()
+#include <assert.h> // assert()
+#include <stdio.h> // NULL
+
+// ------------------- SCALAR ARITHMETIC -------------------
+// The interval code below only uses the dd_* functions, so it is the same
+// for both representations of liczba_dd.
+
+#ifdef ARY_DD_LONG_DOUBLE
+
+liczba_dd dd_from_double(double x) {
+	return (liczba_dd)x;
+}
+double liczba_dd_na_double(liczba_dd x) {
+	return (double)x;
+}
+liczba_dd dd_add(liczba_dd a, liczba_dd b) {
+	return a + b;
+}
+liczba_dd dd_mul(liczba_dd a, liczba_dd b) {
+	return a * b;
+}
+liczba_dd dd_div(liczba_dd a, liczba_dd b) {
+	return a / b;
+}
+liczba_dd dd_neg(liczba_dd a) {
+	return -a;
+}
+// is a < b (false if any of the arguments is NAN)
+bool dd_lt(liczba_dd a, liczba_dd b) {
+	return a < b;
+}
+
+#else
+
+liczba_dd dd_from_double(double x) {
+	return (liczba_dd){.hi = x, .lo = 0.0};
+}
+double liczba_dd_na_double(liczba_dd x) {
+	return x.hi;
+}
+
+// s + err = a + b exactly, assuming |a| >= |b|
+liczba_dd quick_two_sum(double a, double b) {
+	double s = a + b;
+	if(!isfinite(s)) return dd_from_double(s);
+	return (liczba_dd){.hi = s, .lo = b - (s - a)};
+}
+// s + err = a + b exactly
+liczba_dd two_sum(double a, double b) {
+	double s = a + b;
+	if(!isfinite(s)) return dd_from_double(s);
+	double bb = s - a;
+	return (liczba_dd){.hi = s, .lo = (a - (s - bb)) + (b - bb)};
+}
+// p + err = a * b exactly
+liczba_dd two_prod(double a, double b) {
+	double p = a * b;
+	if(!isfinite(p)) return dd_from_double(p);
+	return (liczba_dd){.hi = p, .lo = fma(a, b, -p)};
+}
+
+liczba_dd dd_add(liczba_dd a, liczba_dd b) {
+	liczba_dd s = two_sum(a.hi, b.hi);
+	if(!isfinite(s.hi)) return s;
+	liczba_dd t = two_sum(a.lo, b.lo);
+	s = quick_two_sum(s.hi, s.lo + t.hi);
+	return quick_two_sum(s.hi, s.lo + t.lo);
+}
+liczba_dd dd_mul(liczba_dd a, liczba_dd b) {
+	liczba_dd p = two_prod(a.hi, b.hi);
+	if(!isfinite(p.hi)) return p;
+	return quick_two_sum(p.hi, p.lo + (a.hi * b.lo + a.lo * b.hi));
+}
+liczba_dd dd_neg(liczba_dd a) {
+	return (liczba_dd){.hi = -a.hi, .lo = -a.lo};
+}
+liczba_dd dd_div(liczba_dd a, liczba_dd b) {
+	double q1 = a.hi / b.hi;
+	// infinities, zeros and NAN are handled by the leading term alone
+	if(!isfinite(q1) || isinf(b.hi) || !isfinite(a.hi)) return dd_from_double(q1);
+
+	// long division: each step removes the leading term of the remainder
+	liczba_dd r = dd_add(a, dd_neg(dd_mul(dd_from_double(q1), b)));
+	double q2 = r.hi / b.hi;
+	r = dd_add(r, dd_neg(dd_mul(dd_from_double(q2), b)));
+	double q3 = r.hi / b.hi;
+	return dd_add(quick_two_sum(q1, q2), dd_from_double(q3));
+}
+// is a < b (false if any of the arguments is NAN)
+bool dd_lt(liczba_dd a, liczba_dd b) {
+	// bitwise operators keep this branch-free, since the comparisons in dd_min() and dd_max() are unpredictable
+	return (a.hi < b.hi) | ((a.hi >= b.hi) & (a.hi <= b.hi) & (a.lo < b.lo));
+}
+
+#endif
+
+liczba_dd dd_sub(liczba_dd a, liczba_dd b) {
+	return dd_add(a, dd_neg(b));
+}
+bool dd_isnan(liczba_dd a) {
+	return isnan(liczba_dd_na_double(a));
+}
+
+// ------------------- UTILS -------------------
+// Same as in ary.c, but for liczba_dd.
+
+// returns the minimum of a and b (or the other argument if one is NAN)
+liczba_dd dd_min(liczba_dd a, liczba_dd b) {
+	return (dd_isnan(a) | (!dd_isnan(b) & dd_lt(b, a))) ? b : a;
+}
+// returns the maximum of a and b (or the other argument if one is NAN)
+liczba_dd dd_max(liczba_dd a, liczba_dd b) {
+	return (dd_isnan(a) | (!dd_isnan(b) & dd_lt(a, b))) ? b : a;
+}
+
+// swaps values of a and b
+// Requirements: a and b are not NULL
+void dd_swap(wartosc_dd* a, wartosc_dd* b) {
+	assert(a != NULL && b != NULL);
+
+	wartosc_dd c = *a;
+	*a = *b;
+	*b = c;
+}
+
+// is a equal to b (with epsilon approximation)
+// or false if any of the arguments is NAN
+bool dd_eq(liczba_dd a, liczba_dd b) {
+	return fabs(liczba_dd_na_double(dd_sub(a, b))) < EPS;
+}
+// is a less or equal to b (with epsilon approximation)
+// or false if any of the arguments is NAN
+bool dd_leq(liczba_dd a, liczba_dd b) {
+	return dd_lt(a, b) || dd_eq(a, b);
+}
+// is a greater or equal to b (with epsilon approximation)
+// or false if any of the arguments is NAN
+bool dd_geq(liczba_dd a, liczba_dd b) {
+	return dd_lt(b, a) || dd_eq(a, b);
+}
+// returns sign of a (with epsilon approximation) or 0 if a is NAN
+int dd_sgn(liczba_dd a) {
+	if(dd_eq(a, dd_from_double(0.0)) || dd_isnan(a)) return 0;
+	if(dd_lt(a, dd_from_double(0.0))) return -1;
+	return 1;
+}
+// is x equal to signed inf (positive if sign > 0, negative if sign < 0)
+// Requirements: sign != 0
+bool dd_is_inf(liczba_dd x, int sign) {
+	assert(sign != 0);
+
+	double d = liczba_dd_na_double(x);
+	if(!isinf(d)) return false;
+	if(d < 0.0 && sign < 0) return true;
+	if(d > 0.0 && sign > 0) return true;
+	return false;
+}
+
+// frequently used constants
+wartosc_dd dd_empty(void) {
+	return (wartosc_dd){.first = dd_from_double(NAN), .second = dd_from_double(NAN), .is_flipped = false};
+}
+wartosc_dd dd_everything(void) {
+	return (wartosc_dd){.first = dd_from_double(-HUGE_VAL), .second = dd_from_double(HUGE_VAL), .is_flipped = false};
+}
+
+// ------------------- CONVERSIONS -------------------
+
+// returns the greatest double <= x
+double dd_round_down(liczba_dd x) {
+	double d = liczba_dd_na_double(x);
+	if(dd_lt(x, dd_from_double(d))) d = nextafter(d, -HUGE_VAL);
+	return d;
+}
+// returns the smallest double >= x
+double dd_round_up(liczba_dd x) {
+	double d = liczba_dd_na_double(x);
+	if(dd_lt(dd_from_double(d), x)) d = nextafter(d, HUGE_VAL);
+	return d;
+}
+
+wartosc_dd wartosc_na_dd(wartosc w) {
+	return (wartosc_dd){.first = dd_from_double(w.first), .second = dd_from_double(w.second), .is_flipped = w.is_flipped};
+}
+
+wartosc dd_na_wartosc(wartosc_dd w) {
+	if(dd_isnan(w.first)) {
+		return (wartosc){.first = NAN, .second = NAN, .is_flipped = false};
+	}
+	// in both cases first is a lower bound and second is an upper bound of a part of the set
+	wartosc res = {.first = dd_round_down(w.first), .second = dd_round_up(w.second), .is_flipped = w.is_flipped};
+	if(res.is_flipped && !(res.second < res.first)) { // the rounded rays now cover everything
+		return (wartosc){.first = -HUGE_VAL, .second = HUGE_VAL, .is_flipped = false};
+	}
+	return res;
+}
+
+// ------------------- CONSTRUCTORS -------------------
+
+wartosc_dd wartosc_dokladnosc_dd(double x, double p) {
+	assert(p > 0);
+
+	liczba_dd hundred = dd_from_double(100.0);
+	liczba_dd a = dd_div(dd_mul(dd_from_double(x), dd_sub(hundred, dd_from_double(p))), hundred);
+	liczba_dd b = dd_div(dd_mul(dd_from_double(x), dd_add(hundred, dd_from_double(p))), hundred);
+	return (wartosc_dd){.first = dd_min(a, b), .second = dd_max(a, b), .is_flipped = false};
+}
+
+wartosc_dd wartosc_od_do_dd(double x, double y) {
+	return wartosc_na_dd(wartosc_od_do(x, y));
+}
+
+wartosc_dd wartosc_dokladna_dd(double x) {
+	return wartosc_na_dd(wartosc_dokladna(x));
+}
+
+// ------------------- QUERIES -------------------
+
+bool in_wartosc_dd(wartosc_dd w, double x) {
+	if(dd_isnan(w.first)) return false;
+
+	liczba_dd y = dd_from_double(x);
+	if(w.is_flipped) {
+		return dd_geq(y, w.first) || dd_leq(y, w.second);
+	}
+	return dd_geq(y, w.first) && dd_leq(y, w.second);
+}
+
+liczba_dd min_wartosc_dd(wartosc_dd w) {
+	if(dd_isnan(w.first)) return dd_from_double(NAN);
+
+	// if w is flipped then it also 'contains' -inf
+	if(w.is_flipped || dd_is_inf(w.first, -1)) {
+		return dd_from_double(-HUGE_VAL);
+	}
+	return w.first;
+}
+liczba_dd max_wartosc_dd(wartosc_dd w) {
+	if(dd_isnan(w.first)) return dd_from_double(NAN);
+
+	// if w is flipped then it also 'contains' +inf
+	if(w.is_flipped || dd_is_inf(w.second, 1)) {
+		return dd_from_double(HUGE_VAL);
+	}
+	return w.second;
+}
+liczba_dd sr_wartosc_dd(wartosc_dd w) {
+	liczba_dd maxd = max_wartosc_dd(w);
+	liczba_dd mind = min_wartosc_dd(w);
+	if(dd_is_inf(maxd, 1) && dd_is_inf(mind, -1)) {
+		return dd_from_double(NAN);
+	}
+	// as in ary.c, NAN endpoints give NAN
+	return dd_div(dd_add(maxd, mind), dd_from_double(2.0));
+}
+
+// ------------------- OPERATIONS -------------------
+// Same algorithms as in ary.c (see the notes there).
+
+// returns the negation of w
+wartosc_dd dd_negative(wartosc_dd w) {
+	if(dd_isnan(w.first)) return dd_empty();
+	return (wartosc_dd){.first = dd_neg(w.second), .second = dd_neg(w.first), .is_flipped = w.is_flipped};
+}
+
+// are all endpoints of w negative
+bool dd_is_all_negative(wartosc_dd w) {
+	return dd_leq(w.first, dd_from_double(0.0)) && dd_leq(w.second, dd_from_double(0.0));
+}
+
+wartosc_dd plus_dd(wartosc_dd a, wartosc_dd b) {
+	if(a.is_flipped && b.is_flipped) return dd_everything();
+	liczba_dd first = dd_add(a.first, b.first), second = dd_add(a.second, b.second);
+
+	if((a.is_flipped || b.is_flipped) && dd_leq(first, second)) return dd_everything();
+	return (wartosc_dd){.first = first, .second = second, .is_flipped = a.is_flipped || b.is_flipped};
+}
+wartosc_dd minus_dd(wartosc_dd a, wartosc_dd b) {
+	return plus_dd(a, dd_negative(b));
+}
+
+// returns the inverse of w
+wartosc_dd dd_inverse(wartosc_dd w) {
+	liczba_dd zero = dd_from_double(0.0), one = dd_from_double(1.0);
+	if(dd_eq(w.first, zero) && dd_eq(w.second, zero)) return dd_empty();
+
+	wartosc_dd res = {.first = dd_div(one, w.second), .second = dd_div(one, w.first), .is_flipped = w.is_flipped};
+	if(dd_sgn(w.first) * dd_sgn(w.second) == -1) {
+		res.is_flipped = !w.is_flipped;
+		if(dd_eq(res.first, res.second)) res = dd_everything();
+	}
+	if(dd_eq(w.first, zero)) {
+		res.second = dd_from_double(HUGE_VAL);
+		res.is_flipped = false;
+	}
+	if(dd_eq(w.second, zero)) {
+		res.first = dd_from_double(-HUGE_VAL);
+		res.is_flipped = false;
+	}
+	return res;
+}
+
+// multiply a and b if none are flipped
+// Requirements: neither a nor b are flipped
+wartosc_dd dd_mult_not_flipped(wartosc_dd a, wartosc_dd b) {
+	assert(!a.is_flipped && !b.is_flipped);
+
+	liczba_dd p1 = dd_mul(a.first, b.first), p2 = dd_mul(a.first, b.second);
+	liczba_dd p3 = dd_mul(a.second, b.first), p4 = dd_mul(a.second, b.second);
+	return (wartosc_dd){
+		.first = dd_min(dd_min(p1, p2), dd_min(p3, p4)),
+		.second = dd_max(dd_max(p1, p2), dd_max(p3, p4)),
+		.is_flipped = false
+	};
+}
+// multiply a and b if only one is flipped
+// Requirements: *either* a or b is flipped
+wartosc_dd dd_mult_one_flipped(wartosc_dd a, wartosc_dd b) {
+	assert(a.is_flipped ^ b.is_flipped);
+
+	if(a.is_flipped) dd_swap(&a, &b); // now a is not flipped and b is
+
+	int sign = 1;
+	if(dd_is_all_negative(a)) {
+		a = dd_negative(a);
+		sign *= -1;
+	}
+	if(dd_is_all_negative(b)) {
+		b = dd_negative(b);
+		sign *= -1;
+	}
+
+	liczba_dd res1 = dd_min(dd_mul(a.first, b.first), dd_mul(a.second, b.first));
+	liczba_dd res2 = dd_max(dd_mul(a.first, b.second), dd_mul(a.second, b.second));
+
+	if(dd_leq(res1, res2)) return dd_everything();
+
+	wartosc_dd res = (wartosc_dd){.first = res1, .second = res2, .is_flipped = true};
+	if(sign < 0) res = dd_negative(res);
+	return res;
+}
+// multiply a and b if both are flipped
+// Requirements: both a and b are flipped
+wartosc_dd dd_mult_both_flipped(wartosc_dd a, wartosc_dd b) {
+	assert(a.is_flipped && b.is_flipped);
+
+	if(in_wartosc_dd(a, 0.0) || in_wartosc_dd(b, 0.0)) return dd_everything();
+
+	return (wartosc_dd){
+		.first = dd_min(dd_mul(a.first, b.first), dd_mul(a.second, b.second)),
+		.second = dd_max(dd_mul(a.first, b.second), dd_mul(a.second, b.first)),
+		.is_flipped = true
+	};
+}
+
+wartosc_dd razy_dd(wartosc_dd a, wartosc_dd b) {
+	liczba_dd zero = dd_from_double(0.0);
+	if(dd_isnan(a.first) || dd_isnan(b.first)) return dd_empty();
+	if((dd_eq(a.first, zero) && dd_eq(a.second, zero)) || (dd_eq(b.first, zero) && dd_eq(b.second, zero))) {
+		return (wartosc_dd){.first = zero, .second = zero, .is_flipped = false};
+	}
+	if((dd_is_inf(a.first, -1) && dd_is_inf(a.second, 1)) || (dd_is_inf(b.first, -1) && dd_is_inf(b.second, 1))) {
+		return dd_everything();
+	}
+	if(a.is_flipped && b.is_flipped) return dd_mult_both_flipped(a, b);
+	if(a.is_flipped || b.is_flipped) return dd_mult_one_flipped(a, b);
+	return dd_mult_not_flipped(a, b);
+}
+wartosc_dd podzielic_dd(wartosc_dd a, wartosc_dd b) {
+	return razy_dd(a, dd_inverse(b));
+}
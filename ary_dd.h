@@ -0,0 +1,50 @@
+#ifndef _ARY_DD_H_
+#define _ARY_DD_H_
+
+#include "stdbool.h"
+#include "ary.h"
+
+/* Wartości o zwiększonej precyzji: to samo API co ary.h, */
+/* z sufiksem _dd. Domyślnie liczba_dd to double-double   */
+/* (suma hi + lo, ok. 32 cyfr znaczących); po zdefiniowaniu */
+/* ARY_DD_LONG_DOUBLE jest to long double.                */
+
+#ifdef ARY_DD_LONG_DOUBLE
+typedef long double liczba_dd;
+#else
+typedef struct liczba_dd {
+	double hi, lo; // value = hi + lo, |lo| <= ulp(hi) / 2
+} liczba_dd;
+#endif
+
+typedef struct wartosc_dd {
+	liczba_dd first, second; // segment endpoints
+	bool is_flipped;
+} wartosc_dd;
+
+/* liczba_dd_na_double(x) = x zaokrąglone do double       */
+double liczba_dd_na_double(liczba_dd x);
+
+/* wartosc_na_dd(&w) = w (dokładnie)                      */
+wartosc_dd wartosc_na_dd(wartosc w);
+
+/* dd_na_wartosc(&w) = najmniejsza wartosc zawierająca w  */
+/* (końce zaokrąglone na zewnątrz)                        */
+wartosc dd_na_wartosc(wartosc_dd w);
+
+/* Odpowiedniki funkcji z ary.h.                          */
+wartosc_dd wartosc_dokladnosc_dd(double x, double p);
+wartosc_dd wartosc_od_do_dd(double x, double y);
+wartosc_dd wartosc_dokladna_dd(double x);
+
+bool in_wartosc_dd(wartosc_dd w, double x);
+liczba_dd min_wartosc_dd(wartosc_dd w);
+liczba_dd max_wartosc_dd(wartosc_dd w);
+liczba_dd sr_wartosc_dd(wartosc_dd w);
+
+wartosc_dd plus_dd(wartosc_dd a, wartosc_dd b);
+wartosc_dd minus_dd(wartosc_dd a, wartosc_dd b);
+wartosc_dd razy_dd(wartosc_dd a, wartosc_dd b);
+wartosc_dd podzielic_dd(wartosc_dd a, wartosc_dd b);
+
+#endif
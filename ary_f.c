@@ -0,0 +1,233 @@
+#include "ary_f.h"
+#include <math.h> // fabs(), isfinite(), isnan()
+#include <assert.h> // assert()
+#include <stdio.h> // NULL
+#include <stdlib.h> // calloc(), free()
+#include <stdint.h> // uint32_t
+#include <string.h> // memcpy()
+
+// ------------------- CONVERSIONS -------------------
+
+// returns the greatest float <= x
+float f_round_down(double x) {
+	float f = (float)x;
+	uint32_t need = (double)f > x; // whether f has to be moved one step down
+	// floats of the same sign are ordered like their bit patterns (as sign-magnitude
+	// integers), so stepping is adding +-1 there, with no branches to mispredict
+	uint32_t u;
+	memcpy(&u, &f, sizeof(u));
+	// +-0.0 steps to the negative smallest subnormal, so it is stepped as -0.0
+	u |= (((u & 0x7fffffffu) == 0u) & need) << 31;
+	uint32_t sign = u >> 31;
+	u += (0u - need) & (2u * sign - 1u); // towards -inf: +1 for negative f, -1 for positive f
+	memcpy(&f, &u, sizeof(f));
+	return f;
+}
+// returns the smallest float >= x
+float f_round_up(double x) {
+	float f = (float)x;
+	uint32_t need = (double)f < x; // whether f has to be moved one step up
+	uint32_t u;
+	memcpy(&u, &f, sizeof(u));
+	// +-0.0 steps to the positive smallest subnormal, so it is stepped as +0.0
+	u &= ~((((u & 0x7fffffffu) == 0u) & need) << 31);
+	uint32_t sign = u >> 31;
+	u += (0u - need) & (1u - 2u * sign); // towards +inf: +1 for positive f, -1 for negative f
+	memcpy(&f, &u, sizeof(f));
+	return f;
+}
+
+wartosc_f wartosc_na_f(wartosc w) {
+	if(isnan(w.first)) {
+		return (wartosc_f){.first = NAN, .second = NAN, .is_flipped = false};
+	}
+	// in both cases first is a lower bound and second is an upper bound of a part of the set
+	wartosc_f res = {.first = f_round_down(w.first), .second = f_round_up(w.second), .is_flipped = w.is_flipped};
+	if(res.is_flipped && !(res.second < res.first)) { // the rounded rays now cover everything
+		return (wartosc_f){.first = -HUGE_VALF, .second = HUGE_VALF, .is_flipped = false};
+	}
+	return res;
+}
+
+wartosc f_na_wartosc(wartosc_f w) {
+	return (wartosc){.first = w.first, .second = w.second, .is_flipped = w.is_flipped};
+}
+
+// ------------------- QUERIES -------------------
+
+bool in_wartosc_f(wartosc_f w, double x) {
+	return in_wartosc(f_na_wartosc(w), x);
+}
+
+// ------------------- OPERATIONS -------------------
+// Every float is exactly representable as a double, so the operations are
+// the ones from ary.c followed by rounding the result outwards.
+
+wartosc_f plus_f(wartosc_f a, wartosc_f b) {
+	return wartosc_na_f(plus(f_na_wartosc(a), f_na_wartosc(b)));
+}
+wartosc_f minus_f(wartosc_f a, wartosc_f b) {
+	return wartosc_na_f(minus(f_na_wartosc(a), f_na_wartosc(b)));
+}
+wartosc_f razy_f(wartosc_f a, wartosc_f b) {
+	return wartosc_na_f(razy(f_na_wartosc(a), f_na_wartosc(b)));
+}
+wartosc_f podzielic_f(wartosc_f a, wartosc_f b) {
+	return wartosc_na_f(podzielic(f_na_wartosc(a), f_na_wartosc(b)));
+}
+
+// ------------------- ARRAYS -------------------
+
+tablica_f tablica_f_utworz(const wartosc_f* w, size_t n) {
+	assert(n == 0 || w != NULL);
+
+	// the endpoints are padded to whole blocks of 64, so that the kernels below
+	// always run over a whole block
+	size_t bloki = (n + 63) / 64;
+	tablica_f res = {
+		.first = calloc(bloki * 64, sizeof(float)),
+		.second = calloc(bloki * 64, sizeof(float)),
+		.odwrocone = calloc(bloki, sizeof(uint64_t)),
+		.rozmiar = n
+	};
+	assert(bloki == 0 || (res.first != NULL && res.second != NULL && res.odwrocone != NULL));
+	for(size_t i = 0; i < n; i++) {
+		res.first[i] = w[i].first;
+		res.second[i] = w[i].second;
+		res.odwrocone[i / 64] |= (uint64_t)w[i].is_flipped << (i % 64);
+	}
+	return res;
+}
+
+void tablica_f_usun(tablica_f* t) {
+	assert(t != NULL);
+
+	free(t->first);
+	free(t->second);
+	free(t->odwrocone);
+	*t = (tablica_f){.first = NULL, .second = NULL, .odwrocone = NULL, .rozmiar = 0};
+}
+
+wartosc_f tablica_f_element(const tablica_f* t, size_t i) {
+	assert(t != NULL && i < t->rozmiar);
+
+	return (wartosc_f){.first = t->first[i], .second = t->second[i], .is_flipped = (t->odwrocone[i / 64] >> (i % 64)) & 1u};
+}
+
+// ------------------- BATCH OPERATIONS -------------------
+// The arrays are processed in blocks of 64 lanes. A block kernel computes the common
+// case (segments that are not flipped) for all the lanes with no branches and no
+// special cases, so that gcc can vectorise its loop (at -O2 from -march=x86-64-v2 on),
+// and returns the mask of the lanes where that is not the right result. Those lanes and
+// the flipped ones are then recomputed by the operations on single values.
+
+// can [a1; a2] * [b1; b2] skip the special cases of razy(), i.e. are all endpoints finite
+// (so neither segment is empty or [-inf; inf]) and is neither segment [0; 0]
+// (with epsilon approximation); the segments must not be flipped
+static inline bool is_simple_product(double a1, double a2, double b1, double b2) {
+	return isfinite(a1) & isfinite(a2) & isfinite(b1) & isfinite(b2)
+		& ((fabs(a1) >= EPS) | (fabs(a2) >= EPS)) & ((fabs(b1) >= EPS) | (fabs(b2) >= EPS));
+}
+// [a1; a2] * [b1; b2] rounded outwards to [*lo; *hi], the same as mult_not_flipped()
+// when is_simple_product(a1, a2, b1, b2) holds
+static inline void f_mult(double a1, double a2, double b1, double b2, float* lo, float* hi) {
+	// min and max as plain compares (minpd / maxpd); NAN products only occur
+	// in the lanes that are recomputed anyway
+	double p1 = a1 * b1, p2 = a1 * b2, p3 = a2 * b1, p4 = a2 * b2;
+	double lo1 = p1 < p2 ? p1 : p2, lo2 = p3 < p4 ? p3 : p4;
+	double hi1 = p1 > p2 ? p1 : p2, hi2 = p3 > p4 ? p3 : p4;
+	*lo = f_round_down(lo1 < lo2 ? lo1 : lo2);
+	*hi = f_round_up(hi1 > hi2 ? hi1 : hi2);
+}
+// packs the 64 flags (0 or 1) into a mask; any is the OR of the flags, computed
+// in the vectorised loop, so that the packing is skipped for the usual blocks
+static inline uint64_t mask_of(const uint32_t* flags, uint32_t any) {
+	uint64_t res = 0;
+	if(!any) return res;
+	for(size_t j = 0; j < 64; j++) res |= (uint64_t)flags[j] << j;
+	return res;
+}
+
+// the common case of plus(), exact for segments that are not flipped
+// (an empty argument gives NAN endpoints here as well)
+static uint64_t plus_blok(const float* restrict a1, const float* restrict a2, const float* restrict b1,
+		const float* restrict b2, float* restrict lo, float* restrict hi) {
+	for(size_t j = 0; j < 64; j++) {
+		lo[j] = f_round_down((double)a1[j] + (double)b1[j]);
+		hi[j] = f_round_up((double)a2[j] + (double)b2[j]);
+	}
+	return 0;
+}
+// the common case of minus(), a + negative(b) for segments that are not flipped
+static uint64_t minus_blok(const float* restrict a1, const float* restrict a2, const float* restrict b1,
+		const float* restrict b2, float* restrict lo, float* restrict hi) {
+	for(size_t j = 0; j < 64; j++) {
+		lo[j] = f_round_down((double)a1[j] - (double)b2[j]);
+		hi[j] = f_round_up((double)a2[j] - (double)b1[j]);
+	}
+	return 0;
+}
+static uint64_t razy_blok(const float* restrict a1, const float* restrict a2, const float* restrict b1,
+		const float* restrict b2, float* restrict lo, float* restrict hi) {
+	uint32_t special[64], any = 0;
+	for(size_t j = 0; j < 64; j++) {
+		f_mult(a1[j], a2[j], b1[j], b2[j], &lo[j], &hi[j]);
+		special[j] = !is_simple_product(a1[j], a2[j], b1[j], b2[j]);
+		any |= special[j];
+	}
+	return mask_of(special, any);
+}
+static uint64_t podzielic_blok(const float* restrict a1, const float* restrict a2, const float* restrict b1,
+		const float* restrict b2, float* restrict lo, float* restrict hi) {
+	uint32_t special[64], any = 0;
+	for(size_t j = 0; j < 64; j++) {
+		// for a finite b of one sign (and not close to 0), inverse(b) is just [1 / b2; 1 / b1]
+		double c1 = 1.0 / b2[j], c2 = 1.0 / b1[j];
+		bool simple_inverse = isfinite(b1[j]) & isfinite(b2[j]) & ((b1[j] >= EPS) | (b2[j] <= -EPS));
+		f_mult(a1[j], a2[j], c1, c2, &lo[j], &hi[j]);
+		special[j] = !(simple_inverse & is_simple_product(a1[j], a2[j], c1, c2));
+		any |= special[j];
+	}
+	return mask_of(special, any);
+}
+
+// wynik = a op b, with the block kernel blok and op for the lanes it does not handle
+static void wiele_f(const tablica_f* a, const tablica_f* b, tablica_f* wynik,
+		uint64_t (*blok)(const float*, const float*, const float*, const float*, float*, float*),
+		wartosc_f (*op)(wartosc_f, wartosc_f)) {
+	assert(a != NULL && b != NULL && wynik != NULL);
+	assert(a->rozmiar == b->rozmiar && a->rozmiar == wynik->rozmiar);
+
+	// the results go through lo and hi, so that wynik may be equal to a or b
+	float lo[64], hi[64];
+	for(size_t start = 0; start < a->rozmiar; start += 64) {
+		size_t k = start / 64;
+		uint64_t valid = a->rozmiar - start >= 64 ? ~(uint64_t)0 : ((uint64_t)1 << (a->rozmiar - start)) - 1;
+		uint64_t special = blok(a->first + start, a->second + start, b->first + start, b->second + start, lo, hi);
+		special = (special | a->odwrocone[k] | b->odwrocone[k]) & valid;
+		uint64_t flipped = 0;
+		for(size_t j = 0; special != 0; j++, special >>= 1) {
+			if(!(special & 1u)) continue;
+			wartosc_f w = op(tablica_f_element(a, start + j), tablica_f_element(b, start + j));
+			lo[j] = w.first;
+			hi[j] = w.second;
+			flipped |= (uint64_t)w.is_flipped << j;
+		}
+		memcpy(wynik->first + start, lo, sizeof(lo));
+		memcpy(wynik->second + start, hi, sizeof(hi));
+		wynik->odwrocone[k] = flipped;
+	}
+}
+
+void plus_f_wiele(const tablica_f* a, const tablica_f* b, tablica_f* wynik) {
+	wiele_f(a, b, wynik, plus_blok, plus_f);
+}
+void minus_f_wiele(const tablica_f* a, const tablica_f* b, tablica_f* wynik) {
+	wiele_f(a, b, wynik, minus_blok, minus_f);
+}
+void razy_f_wiele(const tablica_f* a, const tablica_f* b, tablica_f* wynik) {
+	wiele_f(a, b, wynik, razy_blok, razy_f);
+}
+void podzielic_f_wiele(const tablica_f* a, const tablica_f* b, tablica_f* wynik) {
+	wiele_f(a, b, wynik, podzielic_blok, podzielic_f);
+}
@@ -0,0 +1,66 @@
+#ifndef _ARY_F_H_
+#define _ARY_F_H_
+
+#include "stdbool.h"
+#include "stddef.h"
+#include "stdint.h"
+#include "ary.h"
+
+/* Wartości o końcach typu float: zajmują połowę pamięci  */
+/* wartosc. Operacje liczą w double i zaokrąglają końce   */
+/* wyniku na zewnątrz, więc wynik zawsze zawiera wynik   */
+/* odpowiedniej operacji z ary.h.                         */
+
+typedef struct wartosc_f {
+	float first, second; // segment endpoints
+	bool is_flipped;
+} wartosc_f;
+
+/* wartosc_na_f(&w) = najmniejsza wartosc_f zawierająca w */
+/* (końce zaokrąglone na zewnątrz)                        */
+wartosc_f wartosc_na_f(wartosc w);
+
+/* f_na_wartosc(&w) = w (dokładnie)                       */
+wartosc f_na_wartosc(wartosc_f w);
+
+/* in_wartosc_f(&w, x) = x \in w                          */
+bool in_wartosc_f(wartosc_f w, double x);
+
+/* Operacje arytmetyczne na wartosc_f.                    */
+wartosc_f plus_f(wartosc_f a, wartosc_f b);
+wartosc_f minus_f(wartosc_f a, wartosc_f b);
+wartosc_f razy_f(wartosc_f a, wartosc_f b);
+wartosc_f podzielic_f(wartosc_f a, wartosc_f b);
+
+/* Tablica wartości wartosc_f przechowywana jako         */
+/* struktura tablic: końce w tablicach first i second     */
+/* (dopełnionych do wielokrotności 64 elementów), a      */
+/* is_flipped elementu i w bicie i % 64 słowa             */
+/* odwrocone[i / 64], dla i = 0..rozmiar-1.               */
+typedef struct tablica_f {
+	float *first, *second; // segment endpoints
+	uint64_t* odwrocone; // is_flipped bits
+	size_t rozmiar;
+} tablica_f;
+
+/* tablica_f_utworz(w, n) = tablica z w[0], ..., w[n-1]   */
+/* wynik należy zwolnić przez tablica_f_usun              */
+tablica_f tablica_f_utworz(const wartosc_f* w, size_t n);
+void tablica_f_usun(tablica_f* t);
+
+/* tablica_f_element(&t, i) = i-ty element t              */
+wartosc_f tablica_f_element(const tablica_f* t, size_t i);
+
+/* Operacje na tablicach: wynik[i] = a[i] op b[i]         */
+/* dla i = 0..rozmiar-1 (a, b i wynik mają ten sam        */
+/* rozmiar; wynik może być równy a lub b). Dają wynik     */
+/* identyczny z operacjami na pojedynczych wartosc_f.     */
+/* Typowe przypadki liczone są bez rozgałęzień blokami    */
+/* po 64 elementy; gcc wektoryzuje te pętle od -O2        */
+/* z -march=x86-64-v2 (SSE4.2) wzwyż.                     */
+void plus_f_wiele(const tablica_f* a, const tablica_f* b, tablica_f* wynik);
+void minus_f_wiele(const tablica_f* a, const tablica_f* b, tablica_f* wynik);
+void razy_f_wiele(const tablica_f* a, const tablica_f* b, tablica_f* wynik);
+void podzielic_f_wiele(const tablica_f* a, const tablica_f* b, tablica_f* wynik);
+
+#endif
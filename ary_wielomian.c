@@ -0,0 +1,67 @@
+#include "ary_wielomian.h"
+#include <math.h> // fmax(), fmin(), isfinite(), isnan()
+#include <assert.h> // assert()
+#include <stdio.h> // NULL
+
+// ------------------- UTILS -------------------
+
+// evaluates the polynomial (or its derivative if derivative is set) with Horner's scheme
+// Requirements: n > 0
+wartosc horner(const double* wsp, size_t n, wartosc x, bool derivative) {
+	assert(n > 0 && wsp != NULL);
+
+	// the coefficient of y^(i-1) in the derivative is i * wsp[i]
+	size_t low = derivative ? 1 : 0;
+	if(n <= low) return wartosc_dokladna(0.0);
+	double top = derivative ? (double)(n - 1) * wsp[n - 1] : wsp[n - 1];
+	wartosc res = wartosc_dokladna(top);
+	for(size_t i = n - 1; i-- > low;) {
+		double coef = derivative ? (double)i * wsp[i] : wsp[i];
+		res = plus(razy(res, x), wartosc_dokladna(coef));
+	}
+	return res;
+}
+
+// is w a non-empty, not flipped segment with finite endpoints
+bool is_bounded(wartosc w) {
+	return !isnan(w.first) && !w.is_flipped && isfinite(w.first) && isfinite(w.second);
+}
+
+// evaluates the mean value form f(c) + f'(x) * (x - c) for c in the middle of x
+// Requirements: x is bounded
+wartosc mean_value(const double* wsp, size_t n, wartosc x) {
+	assert(is_bounded(x));
+
+	double c = sr_wartosc(x);
+	wartosc fc = horner(wsp, n, wartosc_dokladna(c), false);
+	wartosc slope = horner(wsp, n, x, true);
+	return plus(fc, razy(slope, minus(x, wartosc_dokladna(c))));
+}
+
+// ------------------- POLYNOMIALS -------------------
+
+wartosc wielomian(const double* wsp, size_t n, wartosc x, bool zawez) {
+	assert(n > 0 && wsp != NULL);
+
+	wartosc res = horner(wsp, n, x, false);
+	if(!zawez || !is_bounded(x) || !is_bounded(res)) return res;
+
+	// both forms contain the range, so their intersection does as well
+	wartosc mv = mean_value(wsp, n, x);
+	if(!is_bounded(mv)) return res;
+	double first = fmax(res.first, mv.first), second = fmin(res.second, mv.second);
+	if(first > second) return res; // only possible through rounding errors
+	return (wartosc){.first = first, .second = second, .is_flipped = false};
+}
+
+wartosc wymierna(const double* licznik, size_t n, const double* mianownik, size_t m, wartosc x, bool zawez) {
+	return podzielic(wielomian(licznik, n, x, zawez), wielomian(mianownik, m, x, zawez));
+}
+
+void wielomian_wiele(const double* wsp, size_t n, const wartosc* x, wartosc* wynik, size_t k, bool zawez) {
+	assert(k == 0 || (x != NULL && wynik != NULL));
+
+	for(size_t i = 0; i < k; i++) {
+		wynik[i] = wielomian(wsp, n, x[i], zawez);
+	}
+}
@@ -0,0 +1,30 @@
+#ifndef _ARY_WIELOMIAN_H_
+#define _ARY_WIELOMIAN_H_
+
+#include "stdbool.h"
+#include "stddef.h"
+#include "ary.h"
+
+/* Wielomian o współczynnikach wsp[0..n-1] to            */
+/* wsp[0] + wsp[1] y + ... + wsp[n-1] y^(n-1).            */
+
+/* wielomian(wsp, n, &x, zawez) = wartosc zawierająca     */
+/* wartości wielomianu dla y \in x, liczona schematem     */
+/* Hornera. Jeśli zawez, to wynik jest dodatkowo          */
+/* przecinany z formą wartości średniej                   */
+/* f(c) + f'(x) * (x - c), c = sr_wartosc(x)              */
+/* (dla ograniczonych, nieodwróconych x).                 */
+/* warunek początkowy: n > 0                              */
+wartosc wielomian(const double* wsp, size_t n, wartosc x, bool zawez);
+
+/* wymierna(licznik, n, mianownik, m, &x, zawez) =        */
+/* podzielic(wielomian(licznik, n, x, zawez),             */
+/*           wielomian(mianownik, m, x, zawez))           */
+/* warunek początkowy: n > 0, m > 0                       */
+wartosc wymierna(const double* licznik, size_t n, const double* mianownik, size_t m, wartosc x, bool zawez);
+
+/* wynik[i] = wielomian(wsp, n, x[i], zawez)              */
+/* dla i = 0..k-1                                         */
+void wielomian_wiele(const double* wsp, size_t n, const wartosc* x, wartosc* wynik, size_t k, bool zawez);
+
+#endif
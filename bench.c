@@ -0,0 +1,223 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include "ary.h"
+#include "ary_dd.h"
+#include "ary_f.h"
+#include "ary_wielomian.h"
+
+#define N 1000000
+#define REPEATS 5
+
+// random double from [lo; hi]
+double random_double(double lo, double hi) {
+	return lo + (hi - lo) * rand() / (double)RAND_MAX;
+}
+// random non-flipped wartosc not containing 0.0 (so that division does not
+// immediately lead to infinities)
+wartosc random_wartosc(void) {
+	double x = random_double(1.0, 1000.0), y = random_double(1.0, 1000.0);
+	if(rand() % 2) {
+		x = -x;
+		y = -y;
+	}
+	return wartosc_od_do(fmin(x, y), fmax(x, y));
+}
+
+// the polynomial evaluated as a naive chain of razy and plus on powers of x
+wartosc naive_polynomial(const double* wsp, size_t n, wartosc x) {
+	wartosc res = wartosc_dokladna(wsp[0]), power = wartosc_dokladna(1.0);
+	for(size_t i = 1; i < n; i++) {
+		power = razy(power, x);
+		res = plus(res, razy(wartosc_dokladna(wsp[i]), power));
+	}
+	return res;
+}
+
+// seconds elapsed since start
+double seconds_since(clock_t start) {
+	return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+// output: name, nanoseconds per operation and the slowdown relative to base
+void report(const char* name, double t, double base) {
+	printf("%-24s %8.2f ns/op  x%.2f\n", name, t * 1e9 / (N * REPEATS), t / base);
+}
+
+wartosc a[N], b[N], w[N];
+wartosc_dd a_dd[N], b_dd[N], w_dd[N];
+wartosc_f a_f[N], b_f[N];
+tablica_f ta_f, tb_f, tw_f;
+uint64_t puste[(N + 63) / 64];
+double x[N];
+bool nalezy[N];
+// the checksum keeps the compiler from removing the loops
+double sum = 0.0;
+
+// The operations are numbered 0 = plus, 1 = minus, 2 = razy, 3 = podzielic and
+// are called directly, so that no call goes through a function pointer.
+
+// times the plain loop of wartosc operations; the baseline for all the variants
+double time_double(size_t op) {
+	clock_t start = clock();
+	for(size_t r = 0; r < REPEATS; r++) {
+		switch(op) {
+			case 0: for(size_t i = 0; i < N; i++) w[i] = plus(a[i], b[i]); break;
+			case 1: for(size_t i = 0; i < N; i++) w[i] = minus(a[i], b[i]); break;
+			case 2: for(size_t i = 0; i < N; i++) w[i] = razy(a[i], b[i]); break;
+			default: for(size_t i = 0; i < N; i++) w[i] = podzielic(a[i], b[i]); break;
+		}
+		sum += w[r].first;
+	}
+	return seconds_since(start);
+}
+// times the loop of wartosc_dd operations
+double time_dd(size_t op) {
+	clock_t start = clock();
+	for(size_t r = 0; r < REPEATS; r++) {
+		switch(op) {
+			case 0: for(size_t i = 0; i < N; i++) w_dd[i] = plus_dd(a_dd[i], b_dd[i]); break;
+			case 1: for(size_t i = 0; i < N; i++) w_dd[i] = minus_dd(a_dd[i], b_dd[i]); break;
+			case 2: for(size_t i = 0; i < N; i++) w_dd[i] = razy_dd(a_dd[i], b_dd[i]); break;
+			default: for(size_t i = 0; i < N; i++) w_dd[i] = podzielic_dd(a_dd[i], b_dd[i]); break;
+		}
+		sum += liczba_dd_na_double(w_dd[r].first);
+	}
+	return seconds_since(start);
+}
+// times the batch operations on wartosc
+double time_wiele(size_t op) {
+	clock_t start = clock();
+	for(size_t r = 0; r < REPEATS; r++) {
+		switch(op) {
+			case 0: plus_wiele(a, b, w, N, puste); break;
+			case 1: minus_wiele(a, b, w, N, puste); break;
+			case 2: razy_wiele(a, b, w, N, puste); break;
+			default: podzielic_wiele(a, b, w, N, puste); break;
+		}
+		sum += w[r].first;
+	}
+	return seconds_since(start);
+}
+// times the batch operations on tablica_f
+double time_f_wiele(size_t op) {
+	clock_t start = clock();
+	for(size_t r = 0; r < REPEATS; r++) {
+		switch(op) {
+			case 0: plus_f_wiele(&ta_f, &tb_f, &tw_f); break;
+			case 1: minus_f_wiele(&ta_f, &tb_f, &tw_f); break;
+			case 2: razy_f_wiele(&ta_f, &tb_f, &tw_f); break;
+			default: podzielic_f_wiele(&ta_f, &tb_f, &tw_f); break;
+		}
+		sum += tw_f.first[r];
+	}
+	return seconds_since(start);
+}
+
+int main() {
+	srand(2137);
+	for(size_t i = 0; i < N; i++) {
+		a[i] = random_wartosc();
+		b[i] = random_wartosc();
+		a_dd[i] = wartosc_na_dd(a[i]);
+		b_dd[i] = wartosc_na_dd(b[i]);
+		a_f[i] = wartosc_na_f(a[i]);
+		b_f[i] = wartosc_na_f(b[i]);
+		// touch the outputs, so that page faults are not measured
+		w[i] = a[i];
+		w_dd[i] = a_dd[i];
+		x[i] = random_double(-1000.0, 1000.0);
+		nalezy[i] = false;
+	}
+	ta_f = tablica_f_utworz(a_f, N);
+	tb_f = tablica_f_utworz(b_f, N);
+	tw_f = tablica_f_utworz(a_f, N);
+
+	clock_t start;
+
+	printf("membership queries\n");
+	wartosc q = wartosc_od_do(-500.0, 500.0);
+	start = clock();
+	for(size_t r = 0; r < REPEATS; r++) {
+		for(size_t i = 0; i < N; i++) nalezy[i] = in_wartosc(q, x[i]);
+		sum += nalezy[r];
+	}
+	double t_in = seconds_since(start);
+	report("in_wartosc", t_in, t_in);
+	start = clock();
+	for(size_t r = 0; r < REPEATS; r++) {
+		in_wartosc_wiele(q, x, nalezy, N);
+		sum += nalezy[r];
+	}
+	report("in_wartosc_wiele", seconds_since(start), t_in);
+
+	const char* names[] = {"plus", "minus", "razy", "podzielic"};
+	double baseline[4];
+	printf("wartosc, direct calls\n");
+	for(size_t op = 0; op < 4; op++) {
+		baseline[op] = time_double(op);
+		report(names[op], baseline[op], baseline[op]);
+	}
+
+#ifdef ARY_DD_LONG_DOUBLE
+	printf("wartosc_dd: long double\n");
+#else
+	printf("wartosc_dd: double-double\n");
+#endif
+	for(size_t op = 0; op < 4; op++) {
+		char name[32];
+		snprintf(name, sizeof(name), "%s_dd", names[op]);
+		report(name, time_dd(op), baseline[op]);
+	}
+
+	// the batches only save the call from bench.c into ary.c per value, which
+	// matters for the short plus and minus
+	printf("batch operations on wartosc\n");
+	for(size_t op = 0; op < 4; op++) {
+		char name[32];
+		snprintf(name, sizeof(name), "%s_wiele", names[op]);
+		report(name, time_wiele(op), baseline[op]);
+	}
+
+	printf("tablica_f (%zu bytes + 1 bit per value) vs wartosc (%zu bytes)\n", 2 * sizeof(float), sizeof(wartosc));
+	for(size_t op = 0; op < 4; op++) {
+		double t_wiele = time_wiele(op), t_f = time_f_wiele(op);
+		char name[32];
+		snprintf(name, sizeof(name), "%s_f_wiele", names[op]);
+		report(name, t_f, baseline[op]);
+		snprintf(name, sizeof(name), "  vs %s_wiele", names[op]);
+		printf("%-24s x%.2f\n", name, t_f / t_wiele);
+	}
+	tablica_f_usun(&ta_f);
+	tablica_f_usun(&tb_f);
+	tablica_f_usun(&tw_f);
+
+	// tolerance bands around the interesting part of the polynomial
+	for(size_t i = 0; i < N; i++) a[i] = wartosc_dokladnosc(random_double(-2.0, 2.0), 2.0);
+	double wsp[] = {0.3, -1.2, 0.5, 2.0, -0.75, -0.4, 0.1, 0.05, -0.01}; // degree 8
+	size_t n = sizeof(wsp) / sizeof(wsp[0]);
+	const char* poly_names[] = {"naive razy/plus chain", "wielomian", "wielomian zawez"};
+	printf("polynomial of degree %zu\n", n - 1);
+	double base = 0.0;
+	for(size_t method = 0; method < 3; method++) {
+		start = clock();
+		for(size_t r = 0; r < REPEATS; r++) {
+			if(method == 0) {
+				for(size_t i = 0; i < N; i++) w[i] = naive_polynomial(wsp, n, a[i]);
+			} else {
+				wielomian_wiele(wsp, n, a, w, N, method == 2);
+			}
+			sum += w[r].first;
+		}
+		double t = seconds_since(start);
+		if(method == 0) base = t;
+		double width = 0.0;
+		for(size_t i = 0; i < N; i++) width += (w[i].second - w[i].first) / N;
+		report(poly_names[method], t, base);
+		printf("%-24s %8.5f\n", "  average width", width);
+	}
+
+	printf("checksum: %f\n", sum);
+	return 0;
+}
@@ -2,12 +2,20 @@
 #include <math.h>
 #include <assert.h>
 #include "ary.h"
+#include "ary_dd.h"
+#include "ary_f.h"
+#include "ary_wielomian.h"
 
 const double eps = 1e-10;
 bool equal(double x, double y) {
     return fabs(x - y) < eps;
 }
 
+// is x exactly equal to y (or are both NAN)
+bool same(double x, double y) {
+	return (x <= y && x >= y) || (isnan(x) && isnan(y));
+}
+
 // output: [w.first, w.second](w.is_flipped)
 void print(wartosc w) {
 	printf("[%.10f; %.10f](%d)\n", w.first, w.second, w.is_flipped);
@@ -426,5 +434,210 @@ int main() {
     assert(isnan(min_wartosc(ao)));
     assert(isnan(max_wartosc(ao)));
     assert(!in_wartosc(ao, 0.0));
+
+	// BATCH QUERY TESTS
+
+	double xs[] = {-1e9, -200.0, -100.0, -0.005001, -0.005, -0.00499999, 0.0, 0.00999999, 0.01, 0.0100001,
+		1.0, 193.4999999, 193.60101, 700.0, 700.00001, 1e9};
+	size_t nxs = sizeof(xs) / sizeof(xs[0]);
+	wartosc ws[] = {c, d, e, f, k, l, n, p, q, s, wartosc_od_do(-HUGE_VAL, HUGE_VAL), wartosc_od_do(700.0 + 1.5e-10, 800.0)};
+	size_t nws = sizeof(ws) / sizeof(ws[0]);
+	bool wyn[sizeof(xs) / sizeof(xs[0])];
+
+	for(size_t it = 0; it < nws; it++) {
+		in_wartosc_wiele(ws[it], xs, wyn, nxs);
+		for(size_t jt = 0; jt < nxs; jt++) {
+			assert(wyn[jt] == in_wartosc(ws[it], xs[jt]));
+		}
+	}
+
+	for(size_t cnt = 0; cnt <= nws; cnt++) { // unions of the first cnt wartosci
+		zbior_wartosci zb = zbior_utworz(ws, cnt);
+		in_zbior_wiele(&zb, xs, wyn, nxs);
+		for(size_t jt = 0; jt < nxs; jt++) {
+			bool in_any = false;
+			for(size_t it = 0; it < cnt; it++) in_any = in_any || in_wartosc(ws[it], xs[jt]);
+			assert(wyn[jt] == in_any);
+			assert(in_zbior(&zb, xs[jt]) == in_any);
+		}
+		zbior_usun(&zb);
+	}
+
+	// EXTENDED PRECISION TESTS
+
+	for(size_t it = 0; it < nws; it++) { // the same results as for double
+		for(size_t jt = 0; jt < nws; jt++) {
+			wartosc wd[] = {plus(ws[it], ws[jt]), minus(ws[it], ws[jt]), razy(ws[it], ws[jt]), podzielic(ws[it], ws[jt])};
+			wartosc_dd a_dd = wartosc_na_dd(ws[it]), b_dd = wartosc_na_dd(ws[jt]);
+			wartosc_dd wdd[] = {plus_dd(a_dd, b_dd), minus_dd(a_dd, b_dd), razy_dd(a_dd, b_dd), podzielic_dd(a_dd, b_dd)};
+			for(size_t op = 0; op < 4; op++) {
+				wartosc back = dd_na_wartosc(wdd[op]);
+				assert(isnan(back.first) == isnan(wd[op].first));
+				assert(isnan(back.first) || back.is_flipped == wd[op].is_flipped);
+				for(size_t kt = 0; kt < nxs; kt++) {
+					assert(in_wartosc(wd[op], xs[kt]) == in_wartosc_dd(wdd[op], xs[kt]));
+				}
+			}
+		}
+	}
+
+	wartosc_dd big = plus_dd(wartosc_dokladna_dd(1e16), wartosc_dokladna_dd(1.0));
+	big = minus_dd(big, wartosc_dokladna_dd(1e16)); // [1; 1], but [0; 0] or [2; 2] in double
+	assert(liczba_dd_na_double(min_wartosc_dd(big)) > 0.5 && liczba_dd_na_double(min_wartosc_dd(big)) < 1.5);
+	assert(in_wartosc_dd(big, 1.0));
+
+	wartosc third = dd_na_wartosc(podzielic_dd(wartosc_dokladna_dd(1.0), wartosc_dokladna_dd(3.0)));
+	assert(third.first < third.second); // 1/3 is not a double, so it is rounded outwards
+	assert(third.first <= 1.0 / 3.0 && 1.0 / 3.0 <= third.second);
+	assert(nextafter(third.first, 1.0) >= third.second);
+
+	wartosc ddd_d = dd_na_wartosc(podzielic_dd(podzielic_dd(plus_dd(wartosc_od_do_dd(0.615334, 10897.4),
+		wartosc_od_do_dd(0.326213, 311.31)), wartosc_od_do_dd(-10697.4, 22711.4)),
+		podzielic_dd(wartosc_od_do_dd(-5253.39, -0.944231), wartosc_od_do_dd(-0.0544867, -0.0499373))));
+	assert(ddd_d.is_flipped == ddd.is_flipped);
+	assert(fabs(ddd_d.first - ddd.first) <= 1e-9 * fabs(ddd.first));
+	assert(fabs(ddd_d.second - ddd.second) <= 1e-9 * fabs(ddd.second));
+
+	// FLOAT TESTS
+
+	wartosc_f wfs[sizeof(ws) / sizeof(ws[0])];
+	for(size_t it = 0; it < nws; it++) {
+		wfs[it] = wartosc_na_f(ws[it]);
+		for(size_t kt = 0; kt < nxs; kt++) { // rounding is outwards
+			assert(!in_wartosc(ws[it], xs[kt]) || in_wartosc_f(wfs[it], xs[kt]));
+		}
+	}
+	wartosc_f third_f = wartosc_na_f(wartosc_dokladna(1.0 / 3.0));
+	assert(third_f.first < third_f.second);
+	assert(nextafterf(third_f.first, 1.0f) >= third_f.second);
+	wartosc_f tiny_f = wartosc_na_f(wartosc_od_do(-1e-50, 1e-50)); // rounds to +-0.0 and steps from there
+	assert(same(tiny_f.first, -0x1p-149) && same(tiny_f.second, 0x1p-149));
+	wartosc_f zero_f = wartosc_na_f(wartosc_dokladna(0.0));
+	assert(same(zero_f.first, 0.0) && same(zero_f.second, 0.0) && !signbit(zero_f.first));
+
+	wartosc_f (*ops_f[])(wartosc_f, wartosc_f) = {plus_f, minus_f, razy_f, podzielic_f};
+	void (*ops_f_wiele[])(const tablica_f*, const tablica_f*, tablica_f*) = {plus_f_wiele, minus_f_wiele, razy_f_wiele, podzielic_f_wiele};
+	wartosc (*ops_d[])(wartosc, wartosc) = {plus, minus, razy, podzielic};
+	for(size_t op = 0; op < 4; op++) {
+		for(size_t it = 0; it < nws; it++) {
+			for(size_t jt = 0; jt < nws; jt++) {
+				wartosc_f one = ops_f[op](wfs[it], wfs[jt]);
+				wartosc exact = ops_d[op](f_na_wartosc(wfs[it]), f_na_wartosc(wfs[jt]));
+				assert(isnan(exact.first) == isnan(one.first));
+				for(size_t kt = 0; kt < nxs; kt++) {
+					assert(!in_wartosc(exact, xs[kt]) || in_wartosc_f(one, xs[kt]));
+				}
+			}
+		}
+	}
+
+	// the batches on all the pairs (more than one block of 64, the last one partial),
+	// once with a separate result and once with the result in place of a;
+	// the common cases (finite, not flipped) of the batch kernels are in simple
+	wartosc_f simple[] = {wartosc_na_f(wartosc_od_do(-3.0, -1.0)), wartosc_na_f(wartosc_od_do(1.0, 2.0)),
+		wartosc_na_f(wartosc_od_do(-2.0, 5.0)), wartosc_na_f(wartosc_dokladna(0.1)), wartosc_na_f(wartosc_od_do(1e-11, 1e-3)),
+		wartosc_na_f(wartosc_od_do(-1e30, 3e20)), wartosc_na_f(wartosc_od_do(0.0, 1e-11))};
+	size_t nsimple = sizeof(simple) / sizeof(simple[0]);
+	const wartosc_f* sets_f[] = {wfs, simple};
+	size_t nsets_f[] = {nws, nsimple};
+	for(size_t set = 0; set < 2; set++) {
+		const wartosc_f* vals = sets_f[set];
+		size_t nvals = nsets_f[set];
+		wartosc_f lefts_f[sizeof(ws) / sizeof(ws[0]) * sizeof(ws) / sizeof(ws[0])];
+		wartosc_f rights_f[sizeof(ws) / sizeof(ws[0]) * sizeof(ws) / sizeof(ws[0])];
+		for(size_t it = 0; it < nvals; it++) {
+			for(size_t jt = 0; jt < nvals; jt++) {
+				lefts_f[it * nvals + jt] = vals[it];
+				rights_f[it * nvals + jt] = vals[jt];
+			}
+		}
+		size_t npairs = nvals * nvals;
+		for(size_t op = 0; op < 4; op++) {
+			tablica_f ta = tablica_f_utworz(lefts_f, npairs), tb = tablica_f_utworz(rights_f, npairs);
+			tablica_f tw = tablica_f_utworz(lefts_f, npairs);
+			ops_f_wiele[op](&ta, &tb, &tw);
+			ops_f_wiele[op](&ta, &tb, &ta);
+			for(size_t it = 0; it < npairs; it++) {
+				wartosc_f one = ops_f[op](lefts_f[it], rights_f[it]);
+				wartosc_f res_f = tablica_f_element(&tw, it), res_in = tablica_f_element(&ta, it);
+				assert(same(one.first, res_f.first) && same(one.second, res_f.second));
+				assert(isnan(one.first) || one.is_flipped == res_f.is_flipped);
+				assert(same(res_f.first, res_in.first) && same(res_f.second, res_in.second));
+				assert(res_f.is_flipped == res_in.is_flipped);
+			}
+			tablica_f_usun(&ta);
+			tablica_f_usun(&tb);
+			tablica_f_usun(&tw);
+			assert(ta.first == NULL && ta.rozmiar == 0);
+		}
+	}
+	tablica_f empty_f = tablica_f_utworz(NULL, 0);
+	plus_f_wiele(&empty_f, &empty_f, &empty_f);
+	tablica_f_usun(&empty_f);
+
+	// BATCH OPERATION TESTS
+
+	raport_wiele (*ops_wiele[])(const wartosc*, const wartosc*, wartosc*, size_t, uint64_t*) = {plus_wiele, minus_wiele, razy_wiele, podzielic_wiele};
+	wartosc zero = wartosc_dokladna(0.0);
+	wartosc lefts[70], rights[70], res_w[70];
+	for(size_t it = 0; it < 70; it++) { // more than one block of 64
+		lefts[it] = ws[it % nws];
+		rights[it] = it % 9 == 0 ? zero : ws[(it * 7) % nws];
+	}
+	for(size_t op = 0; op < 4; op++) {
+		uint64_t puste[2];
+		raport_wiele raport = ops_wiele[op](lefts, rights, res_w, 70, puste);
+		size_t empty_count = 0, zero_count = 0;
+		for(size_t it = 0; it < 70; it++) {
+			wartosc one = ops_d[op](lefts[it], rights[it]);
+			assert(same(one.first, res_w[it].first) && same(one.second, res_w[it].second));
+			assert(isnan(one.first) || one.is_flipped == res_w[it].is_flipped);
+			assert(isnan(one.first) == (bool)((puste[it / 64] >> (it % 64)) & 1));
+			empty_count += isnan(one.first) ? 1 : 0;
+			zero_count += op == 3 && same(rights[it].first, 0.0) && same(rights[it].second, 0.0) ? 1 : 0;
+		}
+		assert(raport.puste == empty_count);
+		assert(raport.dzielenie_przez_zero == zero_count);
+	}
+	razy_wiele(lefts, rights, res_w, 70, NULL);
+	razy_wiele(lefts, rights, lefts, 70, NULL); // wynik equal to a
+	for(size_t it = 0; it < 70; it++) {
+		assert(same(lefts[it].first, res_w[it].first) && same(lefts[it].second, res_w[it].second));
+	}
+
+	// POLYNOMIAL TESTS
+
+	double wsp[] = {1.0, -3.0, 1.0}; // 1 - 3y + y^2, which is [-1; 1] on [0; 1]
+	wartosc unit = wartosc_od_do(0.0, 1.0);
+	wartosc hor = wielomian(wsp, 3, unit, false); // [-2; 1]
+	assert(equal(min_wartosc(hor), -2.0) && equal(max_wartosc(hor), 1.0));
+	wartosc tight = wielomian(wsp, 3, unit, true); // [-1.75; 1]
+	assert(equal(min_wartosc(tight), -1.75) && equal(max_wartosc(tight), 1.0));
+	assert(equal(min_wartosc(wielomian(wsp, 1, unit, true)), 1.0)); // constant
+	assert(isnan(min_wartosc(wielomian(wsp, 3, q, true)))); // empty argument
+
+	double wsp2[] = {0.5, -2.0, 0.0, 3.0, -1.0, 0.25}; // degree 5
+	wartosc args[] = {unit, wartosc_od_do(-2.0, 3.0), wartosc_od_do(1.4, 1.5), wartosc_dokladnosc(2.0, 5.0), e, wartosc_dokladna(-0.7)};
+	size_t nargs = sizeof(args) / sizeof(args[0]);
+	wartosc vals[sizeof(args) / sizeof(args[0])];
+	for(size_t zt = 0; zt < 2; zt++) {
+		wielomian_wiele(wsp2, 6, args, vals, nargs, zt);
+		for(size_t it = 0; it < nargs; it++) {
+			wartosc one = wielomian(wsp2, 6, args[it], zt);
+			assert(same(one.first, vals[it].first) && same(one.second, vals[it].second));
+			if(args[it].is_flipped) continue;
+			for(size_t st = 0; st <= 100; st++) { // every value is in the result
+				double arg = args[it].first + (args[it].second - args[it].first) * (double)st / 100.0;
+				double val = ((((0.25 * arg - 1.0) * arg + 3.0) * arg + 0.0) * arg - 2.0) * arg + 0.5;
+				assert(in_wartosc(one, val));
+			}
+		}
+	}
+
+	double num[] = {1.0, 1.0}, den[] = {-2.0, 1.0}; // (y + 1) / (y - 2), which is [2.5; 4] on [3; 4]
+	wartosc rat = wymierna(num, 2, den, 2, wartosc_od_do(3.0, 4.0), true);
+	assert(in_wartosc(rat, 2.5) && in_wartosc(rat, 4.0));
+	rat = wymierna(num, 2, den, 2, wartosc_od_do(1.0, 3.0), false); // the denominator contains 0
+	assert(isinf(min_wartosc(rat)) && isinf(max_wartosc(rat)));
 	return 0;
 }